@@ -1,14 +1,27 @@
+# Exodus output every output_interval time steps
+output_interval = 10
+
 [Mesh]
-  second_order = true
+  # The second order, partitioned mesh is cached in Mesh3_second_order.cpr by the first run
+  # on a given number of processes
   [fmg]
-    type = FileMeshGenerator
+    type = CachedFileMeshGenerator
     file = Mesh3.exo
+    second_order = true
   []
 []
 #[Mesh]
 #  file = NACA_airfoil_PP.e
 #[]
 
+[Problem]
+  # The pressure Laplacian never changes: the Jacobian and the BoomerAMG hierarchy are built by
+  # the first solve and reused by all the following ones
+  type = ConstantJacobianFEProblem
+  # The pressure changes slowly: start every solve from its projection onto the last ones
+  krylov_guess = fischer
+[]
+
 [Variables]
   # Pressure
   [./p]
@@ -18,8 +31,8 @@
     #initial_from_file_timestep = LATEST
 
     [./InitialCondition]
-      type = ConstantIC
-      value = 0
+      type = FunctionIC
+      function = p_ic
     [../]
   [../]
 []
@@ -33,8 +46,8 @@
     #initial_from_file_timestep = LATEST
 
     [./InitialCondition]
-      type = ConstantIC
-      value = 1.0
+      type = FunctionIC
+      function = u_star_ic
     [../]
   [../]
 
@@ -46,8 +59,8 @@
     #initial_from_file_timestep = LATEST
 
     [./InitialCondition]
-      type = ConstantIC
-      value = 0.05
+      type = FunctionIC
+      function = v_star_ic
     [../]
   [../]
 
@@ -58,8 +71,8 @@
     #initial_from_file_timestep = LATEST
 
     [./InitialCondition]
-      type = ConstantIC
-      value = 1.0
+      type = FunctionIC
+      function = u_ic
     [../]
   [../]
   [./v]
@@ -69,8 +82,8 @@
     #initial_from_file_timestep = LATEST
 
     [./InitialCondition]
-      type = ConstantIC
-      value = 0.0
+      type = FunctionIC
+      function = v_ic
     [../]
   [../]
   [./p_current]
@@ -88,6 +101,35 @@
   [../]
 []
 
+[Functions]
+  # Initial values; scripts/nested_iteration.py sets their solution to start from a coarser mesh
+  [p_ic]
+    type = NestedIterationFunction
+    value = 0
+    from_variable = p
+  []
+  [u_star_ic]
+    type = NestedIterationFunction
+    value = 1.0
+    from_variable = u_star
+  []
+  [v_star_ic]
+    type = NestedIterationFunction
+    value = 0.05
+    from_variable = v_star
+  []
+  [u_ic]
+    type = NestedIterationFunction
+    value = 1.0
+    from_variable = u
+  []
+  [v_ic]
+    type = NestedIterationFunction
+    value = 0.0
+    from_variable = v
+  []
+[]
+
 [Kernels]
   [./PressurePoisson]
     type = NavStokesPressurePoisson_p
@@ -171,17 +213,32 @@
   picard_max_its = 1
 []
 
+# Timeline of one time step of both apps, open in chrome://tracing or ui.perfetto.dev
+# [UserObjects]
+#   [trace]
+#     type = ChromeTraceWriter
+#     start_step = 5
+#     num_steps = 1
+#   []
+# []
+
 [MultiApps]
   [./sub_predictor]
-    type = TransientMultiApp
+    # Records the predictor time steps in the trace of the trace UserObject
+    type = TracedTransientMultiApp
     input_files = NS_Predictor_airfoil.i
     execute_on = TIMESTEP_BEGIN
+    # The predictor works on a copy of this mesh, so its partitioning and numbering match those
+    # of this app for the copy transfers; its [Mesh] block is then ignored. The copy takes as
+    # much memory as the mesh itself
+    clone_master_mesh = true
   [../]
 []
 
 [Transfers]
+  # The stock copy, also recorded in the trace of the trace UserObject
   [./u_star_from_sub_predictor]
-    type = MultiAppCopyTransfer
+    type = TracedMultiAppCopyTransfer
     direction = from_multiapp
     multi_app = sub_predictor
     source_variable = u_star
@@ -189,7 +246,7 @@
   [../]
 
   [./v_star_from_sub_predictor]
-    type = MultiAppCopyTransfer
+    type = TracedMultiAppCopyTransfer
     direction = from_multiapp
     multi_app = sub_predictor
     source_variable = v_star
@@ -197,7 +254,7 @@
   [../]
 
   [./u_to_sub_predictor]
-    type = MultiAppCopyTransfer
+    type = TracedMultiAppCopyTransfer
     #type = MultiAppCopyTransfer
     direction = to_multiapp
     multi_app = sub_predictor
@@ -206,7 +263,7 @@
   [../]
 
   [./v_to_sub_predictor]
-    type = MultiAppCopyTransfer
+    type = TracedMultiAppCopyTransfer
     #type = MultiAppCopyTransfer
     direction = to_multiapp
     multi_app = sub_predictor
@@ -215,7 +272,7 @@
   [../]
 
   [./p_to_sub_predictor]
-    type = MultiAppCopyTransfer
+    type = TracedMultiAppCopyTransfer
     direction = to_multiapp
     multi_app = sub_predictor
     source_variable = p
@@ -225,6 +282,17 @@
 
 [Outputs]
   file_base = NACA_airfoil_Chorin
-  exodus = true
-  checkpoint = true
+  # The star velocities and the pressure iterates only carry data between the stages, so only
+  # the physical fields are written
+  [exodus]
+    type = Exodus
+    show = 'u v p'
+    interval = ${output_interval}
+  []
+  # Only the primitive fields are needed to restart the split solver. Restart with a
+  # FieldRestartReader UserObject, file = NACA_airfoil_Chorin_fields_<step>
+  [fields]
+    type = FieldRestartOutput
+    variables = 'u v p p_old'
+  []
 []
@@ -14,6 +14,8 @@
 #include "INSFVVelocityVariable.h"
 #include "INSFVPressureVariable.h"
 
+class FVCellGradientCache;
+
 /**
  * Auxiliary kernel responsible for computing the Darcy velocity given
  * several fluid properties and the pressure gradient.
@@ -37,12 +39,17 @@ protected:
   const INSFVPressureVariable * const _p_var;
   const INSFVPressureVariable * const _p_old;
 
+  /// Optional shared cell gradients, and the indices of the pressures in them
+  const FVCellGradientCache * const _grad_cache;
+  const unsigned int _p_grad_index;
+  const unsigned int _p_old_grad_index;
+
   // Velocity components
   //const INSFVVelocityVariable * const _vel_star;
 
-  /// Transfer Variables
-  const MooseVariableFVReal * const _Ainv;
-  const MooseVariableFVReal * const _Hhat;
+  /// Transfer Variables. Only their values are needed, so no dual numbers are built
+  const VariableValue & _Ainv;
+  const VariableValue & _Hhat;
 
   //// Access to the current element
   //const Elem * const & _current_elem;
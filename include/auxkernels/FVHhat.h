@@ -14,6 +14,8 @@
 #include "INSFVVelocityVariable.h"
 #include "INSFVPressureVariable.h"
 
+class FVCellGradientCache;
+
 /**
  * Auxiliary kernel responsible for computing the Darcy velocity given
  * several fluid properties and the pressure gradient.
@@ -36,10 +38,14 @@ protected:
   // Pressures
   const INSFVPressureVariable * const _p_mom_predictor;
 
-  /// Transfer Variables
-  const MooseVariableFVReal * const _Ainv;
-  const MooseVariableFVReal * const _Hu;
-  const MooseVariableFVReal * const _rhs;
+  /// Optional shared cell gradients, and the index of the pressure in them
+  const FVCellGradientCache * const _grad_cache;
+  const unsigned int _p_grad_index;
+
+  /// Transfer Variables. Only their values are needed, so no dual numbers are built
+  const VariableValue & _Ainv;
+  const VariableValue & _Hu;
+  const VariableValue & _rhs;
 
   //// Access to the current element
   //const Elem * const & _current_elem;
@@ -0,0 +1,62 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "AuxKernel.h"
+#include "INSFVVelocityVariable.h"
+#include "WallFunctionUtils.h"
+
+class WallFunctionFrictionVelocity;
+
+/**
+ * Computes wall shear stress using the algebraic standard velocity wall functions.
+ * The wall-adjacent cells, together with the normal of and distance to their
+ * nearest wall face, are tabulated once so that interior cells are skipped
+ * with a single lookup. Named apart from the Navier-Stokes module's
+ * WallFunctionWallShearStressAux, which it otherwise mirrors.
+ */
+class WallFunctionTabulatedShearStressAux : public AuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  WallFunctionTabulatedShearStressAux(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+protected:
+  virtual Real computeValue() override;
+
+  /// the dimension of the simulation
+  const unsigned int _dim;
+
+  /// x-velocity
+  const INSFVVelocityVariable * const _u_var;
+  /// y-velocity
+  const INSFVVelocityVariable * const _v_var;
+  /// z-velocity
+  const INSFVVelocityVariable * const _w_var;
+
+  /// density
+  const Real _rho;
+
+  /// dynamic viscosity
+  const ADMaterialProperty<Real> & _mu;
+
+  /// Wall boundaries
+  const std::vector<BoundaryName> & _wall_boundary_names;
+
+  /// Optional batched friction velocity evaluator
+  const WallFunctionFrictionVelocity * const _friction_velocity;
+
+  /// Wall-adjacent cells, keyed by element id
+  std::unordered_map<dof_id_type, WallFunction::WallCell> _wall_cells;
+};
@@ -15,6 +15,8 @@
 // System includes
 #include <string>
 #include <fstream>
+#include <memory>
+#include <vector>
 
 // Forward Declarations
 class CustomTransient;
@@ -289,4 +291,24 @@ protected:
   /// steady-state, this member should probably be be false.
   const bool _normalize_solution_diff_norm_by_dt;
   const bool & _verbose_print;
+
+  /**
+   * Saves the solution of the converged step for extrapolating the initial guesses of the next
+   * steps
+   * @param time The time of the step
+   */
+  void storeStepSolution(Real time);
+
+  /**
+   * Replaces the current solution by the polynomial extrapolation of the last step solutions to
+   * the current time. Starts with lower degrees until enough steps are stored.
+   */
+  void extrapolateInitialGuess();
+
+  /// Degree of the initial guess extrapolation, 0 to start from the previous solution
+  const unsigned int _extrapolation_degree;
+
+  /// The last step solutions, newest first, and their times
+  std::vector<std::unique_ptr<NumericVector<Number>>> _step_solutions;
+  std::vector<Real> _step_times;
 };
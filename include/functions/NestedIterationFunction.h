@@ -0,0 +1,46 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Function.h"
+
+class SolutionUserObject;
+
+/**
+ * Initial condition function of the nested iteration startup. It is a constant
+ * for a cold start; given a SolutionUserObject holding the result on the
+ * previous (coarser) mesh, it evaluates the solution of that mesh instead.
+ * Used through a FunctionIC, the initial condition machinery then projects it
+ * onto the new mesh: an element-wise L2 projection for discontinuous and FV
+ * variables (cell averages for constant monomials), and a vertex interpolation
+ * with L2 fits of the higher order dofs for Lagrange variables.
+ * See scripts/nested_iteration.py.
+ */
+class NestedIterationFunction : public Function
+{
+public:
+  static InputParameters validParams();
+
+  NestedIterationFunction(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+  virtual Real value(Real t, const Point & p) const override;
+
+protected:
+  /// Cold start value
+  const Real _value;
+
+  /// Solution of the previous mesh, if any
+  const SolutionUserObject * _solution;
+
+  /// The variable of the previous solution to evaluate
+  const std::string _from_variable;
+};
@@ -0,0 +1,27 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+/**
+ * Implemented by residual objects whose Jacobian contribution depends neither
+ * on the solution nor on time or the time step size, so that a Jacobian they
+ * assembled once stays exact for the whole run on a fixed mesh. See
+ * ConstantJacobianFEProblem.
+ */
+class ConstantJacobianInterface
+{
+public:
+  virtual ~ConstantJacobianInterface() = default;
+
+  /**
+   * @return Whether the Jacobian contribution is constant with the current coupling
+   */
+  virtual bool constantJacobian() const = 0;
+};
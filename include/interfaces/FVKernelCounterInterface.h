@@ -0,0 +1,46 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include <map>
+#include <string>
+
+/**
+ * Named event counters (faces visited, cache hits, ...) for the finite volume
+ * kernels. Every threaded copy of a kernel owns its counters, so incrementing
+ * them needs no synchronization; the FVKernelCounter postprocessor sums them
+ * over threads and processes. Counters are cumulative over the whole run.
+ */
+class FVKernelCounterInterface
+{
+public:
+  virtual ~FVKernelCounterInterface() = default;
+
+  /**
+   * @return Whether a counter named \p name was declared
+   */
+  bool hasCounter(const std::string & name) const { return _counters.count(name); }
+
+  /**
+   * @return The current value of the counter \p name
+   */
+  unsigned long long counter(const std::string & name) const { return _counters.at(name); }
+
+protected:
+  /**
+   * Declares the counter \p name and returns a reference for incrementing it.
+   * The reference stays valid for the lifetime of the object
+   */
+  unsigned long long & declareCounter(const std::string & name) { return _counters[name] = 0; }
+
+private:
+  /// The counters, by name
+  std::map<std::string, unsigned long long> _counters;
+};
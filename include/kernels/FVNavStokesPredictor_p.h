@@ -15,6 +15,7 @@
 #include "SubProblem.h"
 #include "MooseApp.h"
 #include "INSFVAttributes.h"
+#include "FVKernelCounterInterface.h"
 
 #include <vector>
 #include <set>
@@ -26,13 +27,19 @@ class INSFVPressureVariable;
  * An advection kernel that implements interpolation schemes specific to Navier-Stokes flow
  * physics
  */
-class FVNavStokesPredictor_p : public FVMatAdvection
+class FVNavStokesPredictor_p : public FVMatAdvection, public FVKernelCounterInterface
 {
 public:
   static InputParameters validParams();
   FVNavStokesPredictor_p(const InputParameters & params);
   void initialSetup() override;
 
+  /**
+   * Estimates the memory held by the Rhie-Chow 'a' coefficient cache of \p app, over all threads
+   * @return The number of cached coefficients and their approximate size in bytes
+   */
+  static std::pair<std::size_t, std::size_t> rcCoeffCacheFootprint(const MooseApp & app);
+
 protected:
   /**
    * interpolation overload for the velocity
@@ -117,6 +124,13 @@ protected:
   /// index x|y|z
   const unsigned int _index;
 
+  /// Number of faces visited
+  unsigned long long & _face_count;
+
+  /// Rhie-Chow 'a' coefficient cache hits and misses
+  unsigned long long & _rc_hits;
+  unsigned long long & _rc_misses;
+
 private:
   /**
    * Query for \p INSFVBCs::INSFVFlowBC on \p bc_id and add if query successful
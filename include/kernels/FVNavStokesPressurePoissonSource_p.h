@@ -0,0 +1,55 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "FVElementalKernel.h"
+#include "FVKernelCounterInterface.h"
+
+class INSFVVelocityVariable;
+class FVCellGradientCache;
+
+/**
+ * Elemental source term -(rho / dt) * div(u*) of the pressure Poisson equation
+ * used by the "split" scheme. The star velocity is an auxiliary field, so
+ * only the value of its divergence is needed.
+ */
+class FVNavStokesPressurePoissonSource_p : public FVElementalKernel, public FVKernelCounterInterface
+{
+public:
+  static InputParameters validParams();
+
+  FVNavStokesPressurePoissonSource_p(const InputParameters & parameters);
+
+protected:
+  virtual ADReal computeQpResidual() override;
+
+  /**
+   * Returns the divergence of the star velocity on \p elem
+   * @param elem The element to evaluate the divergence on
+   */
+  Real velocityDivergence(const Elem & elem);
+
+  /// Density
+  const Moose::Functor<ADReal> & _rho;
+
+  /// x-velocity
+  const INSFVVelocityVariable * const _u_star;
+  /// y-velocity
+  const INSFVVelocityVariable * const _v_star;
+  /// z-velocity
+  const INSFVVelocityVariable * const _w_star;
+
+  /// Optional shared cell gradients, and the indices of the star velocities in them
+  const FVCellGradientCache * const _grad_cache;
+  std::vector<unsigned int> _vel_grad_indices;
+
+  /// Number of elements visited
+  unsigned long long & _elem_count;
+};
@@ -10,15 +10,17 @@
 #pragma once
 
 #include "FVFluxKernel.h"
+#include "FVKernelCounterInterface.h"
 
 // Forward Declarations
 
 /**
  * This class computes the pressure Poisson solve which is part of
  * the "split" scheme used for solving the incompressible Navier-Stokes
- * equations.
+ * equations. Only the diffusion flux lives here; the velocity divergence
+ * source is an elemental contribution, see FVNavStokesPressurePoissonSource_p.
  */
-class FVNavStokesPressurePoisson_p: public FVFluxKernel
+class FVNavStokesPressurePoisson_p: public FVFluxKernel, public FVKernelCounterInterface
 {
 public:
   static InputParameters validParams();
@@ -30,7 +32,6 @@ public:
 protected:
 
   // Material properties
-  const Moose::Functor<ADReal> & _rho; //Density
   const Moose::Functor<ADReal> & _mu; //Dynamic viscosity
 
   // Override QP residual
@@ -38,19 +39,7 @@ protected:
 
   /// pressure variable
   const INSFVPressureVariable * const _p_old;
-  /// x-velocity
-  const INSFVVelocityVariable * const _u_star;
-  /// y-velocity
-  const INSFVVelocityVariable * const _v_star;
-  /// z-velocity
-  const INSFVVelocityVariable * const _w_star;
-
-  // Variable numberings
-  unsigned _u_vel_star_var_number;
-  unsigned _v_vel_star_var_number;
-  unsigned _w_vel_star_var_number;
-
-  //// Access to the current element
-  const Elem * const & _current_elem;
 
+  /// Number of faces visited
+  unsigned long long & _face_count;
 };
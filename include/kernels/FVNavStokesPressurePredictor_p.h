@@ -10,6 +10,7 @@
 #pragma once
 
 #include "FVFluxKernel.h"
+#include "FVKernelCounterInterface.h"
 
 // Forward Declarations
 
@@ -18,7 +19,7 @@
  * the "split" scheme used for solving the incompressible Navier-Stokes
  * equations.
  */
-class FVNavStokesPressurePredictor_p: public FVFluxKernel
+class FVNavStokesPressurePredictor_p: public FVFluxKernel, public FVKernelCounterInterface
 {
 public:
   static InputParameters validParams();
@@ -69,4 +70,7 @@ protected:
   const Elem * const & _current_elem;
   unsigned int counter;
 
+  /// Number of faces visited
+  unsigned long long & _face_count;
+
 };
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "Kernel.h"
+#include "ConstantJacobianInterface.h"
 
 // Forward Declarations
 
@@ -17,8 +18,11 @@
  * This class computes the pressure Poisson solve which is part of
  * the "split" scheme used for solving the incompressible Navier-Stokes
  * equations.
+ *
+ * The Jacobian is the Laplacian, constant unless the star velocity is a
+ * nonlinear variable, in which case the divergence couples it through rho / dt.
  */
-class NavStokesPressurePoisson_p: public Kernel
+class NavStokesPressurePoisson_p: public Kernel, public ConstantJacobianInterface
 {
 public:
   static InputParameters validParams();
@@ -27,6 +31,8 @@ public:
 
   virtual ~NavStokesPressurePoisson_p() {}
 
+  virtual bool constantJacobian() const override { return _constant_jacobian; }
+
 protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
@@ -47,4 +53,7 @@ protected:
 
   // Material properties
   const MaterialProperty<Real> & _rho;
+
+  // Whether the star velocities are auxiliary variables
+  bool _constant_jacobian;
 };
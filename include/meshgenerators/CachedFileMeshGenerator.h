@@ -0,0 +1,44 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MeshGenerator.h"
+
+/**
+ * Reads an Exodus mesh like FileMeshGenerator, optionally converts it to second
+ * order, and keeps the prepared and partitioned result in a binary split
+ * (CheckpointIO) cache. Later runs on the same number of processes read the
+ * cache instead of reading, converting and partitioning the Exodus file again.
+ * The cache is rebuilt when the Exodus file is newer than it.
+ *
+ * Only a distributed mesh (Mesh/parallel_type = distributed) makes each process
+ * read just its own piece and ghost layer. A replicated mesh reads every piece
+ * on every process, so the cache then saves the Exodus read and the conversion
+ * but not the memory or the reading time of the whole mesh.
+ */
+class CachedFileMeshGenerator : public MeshGenerator
+{
+public:
+  static InputParameters validParams();
+
+  CachedFileMeshGenerator(const InputParameters & parameters);
+
+  std::unique_ptr<MeshBase> generate() override;
+
+protected:
+  /// The Exodus mesh
+  const MeshFileName & _file;
+
+  /// Whether to convert the mesh to second order before caching it
+  const bool _second_order;
+
+  /// Split directory of the cache, holding one set of pieces per number of processes
+  const std::string _cache;
+};
@@ -0,0 +1,27 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "TransientMultiApp.h"
+
+/**
+ * TransientMultiApp recording the time steps of its sub apps with the
+ * TraceRecorder, on a track named after the MultiApp. This traces the sub app
+ * solves from the parent, whatever executioner the sub apps use.
+ */
+class TracedTransientMultiApp : public TransientMultiApp
+{
+public:
+  static InputParameters validParams();
+
+  TracedTransientMultiApp(const InputParameters & parameters);
+
+  virtual bool solveStep(Real dt, Real target_time, bool auto_advance = true) override;
+};
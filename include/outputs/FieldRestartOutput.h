@@ -0,0 +1,55 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "FileOutput.h"
+
+#include <deque>
+#include <future>
+
+/**
+ * Writes a compact restart of the primitive fields only: the owned dofs of the
+ * given variables, per rank, in the FieldRestart binary layout. The values are
+ * copied out of the solution synchronously and written to disk by a background
+ * thread, so the solve continues while the file is written. Read back with
+ * FieldRestartReader.
+ */
+class FieldRestartOutput : public FileOutput
+{
+public:
+  static InputParameters validParams();
+
+  FieldRestartOutput(const InputParameters & parameters);
+  virtual ~FieldRestartOutput();
+
+  /// The prefix of the files of the current step, without the rank suffix
+  virtual std::string filename() override;
+
+protected:
+  virtual void output(const ExecFlagType & type) override;
+
+  /// Serializes the owned dofs of the variables into a buffer in the FieldRestart layout
+  std::vector<char> pack();
+
+  /// Joins the background write, rethrowing its errors
+  void waitForWrite();
+
+  /// The variables to write
+  const std::vector<VariableName> & _variables;
+
+  /// Number of restarts to keep on disk
+  const unsigned int _num_files;
+
+  /// The background write of the previous restart
+  std::future<void> _write;
+
+  /// Files written by this rank, oldest first
+  std::deque<std::string> _written;
+};
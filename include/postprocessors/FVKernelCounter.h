@@ -0,0 +1,49 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+/**
+ * Reports a counter of the finite volume kernels implementing
+ * FVKernelCounterInterface, summed over threads and processes. Either the
+ * total since the start of the run or the increment since the previous
+ * execution is reported.
+ */
+class FVKernelCounter : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  FVKernelCounter(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  /// The counter to report
+  const std::string & _counter;
+
+  /// The kernels to sum the counter over. All kernels declaring the counter if empty
+  const std::vector<std::string> & _kernels;
+
+  /// Whether to report the increment since the previous execution
+  const bool _per_execution;
+
+  /// The counter total of the current execution
+  Real _total;
+
+  /// The counter total of the previous execution
+  Real & _previous_total;
+
+  /// The value reported by this execution
+  Real _value;
+};
@@ -0,0 +1,107 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MoosePreconditioner.h"
+#include "MeshChangedInterface.h"
+
+#include "libmesh/preconditioner.h"
+
+#include <petscksp.h>
+
+class NonlinearSystemBase;
+
+/**
+ * Geometric multigrid V-cycle for a single finite volume variable, such as the
+ * pressure of the split scheme. The coarse levels agglomerate neighboring
+ * cells: every aggregate is a cell with its face neighbors, and the aggregates
+ * of one level are agglomerated again for the next one, until the coarsest
+ * level is small enough for a direct solve. Aggregates never cross process
+ * boundaries, so building the hierarchy needs no communication.
+ *
+ * The prolongation is piecewise constant over the aggregates, optionally
+ * smoothed with one damped Jacobi step of the level operator, and the coarse
+ * operators are the Galerkin products P^T A P. The smoothers are Chebyshev
+ * iterations preconditioned with Jacobi, which only need the operator
+ * application and its diagonal.
+ *
+ * The aggregates are rebuilt after a mesh change and whenever the local cells
+ * are renumbered, and the coarse operators whenever the Jacobian is reassembled. The inner solver
+ * takes PETSc options with the prefix gmg_, e.g. -gmg_mg_levels_ksp_max_it.
+ */
+class GeometricMGPreconditioner : public MoosePreconditioner,
+                                  public Preconditioner<Number>,
+                                  public MeshChangedInterface
+{
+public:
+  static InputParameters validParams();
+
+  GeometricMGPreconditioner(const InputParameters & params);
+  virtual ~GeometricMGPreconditioner();
+
+  virtual void init() override;
+
+  virtual void setup() override;
+
+  virtual void apply(const NumericVector<Number> & x, NumericVector<Number> & y) override;
+
+  virtual void clear() override;
+
+  /// Marks the aggregates for a rebuild at the next setup
+  virtual void meshChanged() override;
+
+protected:
+  /// Agglomerates the local cells level by level and builds the piecewise constant prolongations
+  void buildAggregates();
+
+  /**
+   * Groups the vertices of a local graph into aggregates
+   * @param graph The neighbors of every vertex
+   * @param aggregate Filled with the aggregate of every vertex
+   * @return The number of aggregates
+   */
+  static unsigned int agglomerate(const std::vector<std::vector<unsigned int>> & graph,
+                                  std::vector<unsigned int> & aggregate);
+
+  /// Releases the level operators and the inner solver
+  void destroyLevels();
+
+  /// The nonlinear system
+  NonlinearSystemBase & _nl;
+
+  /// The maximum number of levels, including the finest one
+  const unsigned int _max_levels;
+
+  /// Global number of cells below which a level is solved directly
+  const dof_id_type _coarse_size;
+
+  /// Damping of the Jacobi step smoothing the prolongations, 0 for none
+  const Real _prolongation_smoothing;
+
+  /// Number of smoothing iterations on every level
+  const unsigned int _smoothing_steps;
+
+  /// Whether the mesh changed since the aggregates were built
+  bool _mesh_changed;
+
+  /// Number of local cells and first local row the aggregates were built for
+  dof_id_type _n_local_cells;
+  dof_id_type _first_local_cell;
+
+  /// The piecewise constant prolongations, from the finest level down
+  std::vector<Mat> _aggregations;
+
+  /// The (smoothed) prolongations and the coarse operators, from the finest level down
+  std::vector<Mat> _prolongations;
+  std::vector<Mat> _coarse_operators;
+
+  /// The V-cycle
+  KSP _ksp;
+};
@@ -0,0 +1,66 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "FEProblem.h"
+
+#include <petscsnes.h>
+
+/**
+ * FEProblem keeping its Jacobian and preconditioner for the whole run when the
+ * Jacobian cannot change, like the Laplacian of the pressure Poisson equation
+ * on a fixed mesh. The SNES then assembles the Jacobian and sets up the
+ * preconditioner (e.g. the BoomerAMG hierarchy) on its first solve only, and
+ * every later solve only applies it. A mesh change triggers one new setup.
+ *
+ * With reuse_jacobian = auto the Jacobian is considered constant when every
+ * nonlinear residual object implements ConstantJacobianInterface and reports a
+ * constant Jacobian, Dirichlet nodal BCs aside, and neither mesh adaptivity, a
+ * displaced mesh nor finite volume variables are used.
+ *
+ * Successive solves with the same operator can also start from the projection
+ * of the right-hand side onto the solutions of the previous solves
+ * (krylov_guess). PETSc keeps that space for as long as the operator does not
+ * change, i.e. across time steps when the Jacobian is reused.
+ */
+class ConstantJacobianFEProblem : public FEProblem
+{
+public:
+  static InputParameters validParams();
+
+  ConstantJacobianFEProblem(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+  virtual void meshChanged() override;
+
+  /// Records the aux kernel sweeps with the TraceRecorder
+  virtual void computeAuxiliaryKernels(const ExecFlagType & type) override;
+
+  /// Whether the Jacobian and the preconditioner are kept across solves
+  bool reusesJacobian() const { return _reuse; }
+
+protected:
+  /// Whether all the residual objects have a constant Jacobian
+  bool hasConstantJacobian();
+
+  /// The SNES of the nonlinear system
+  SNES snes();
+
+  /// The reuse_jacobian parameter
+  const MooseEnum & _reuse_mode;
+
+  /// Whether the Jacobian is reused, decided in initialSetup
+  bool _reuse;
+
+  /// Initial guess of the linear solves, and the number of previous solutions kept for it
+  const MooseEnum & _krylov_guess;
+  const unsigned int _krylov_guess_size;
+};
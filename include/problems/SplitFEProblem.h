@@ -0,0 +1,111 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "FEProblem.h"
+
+#include <petscmat.h>
+
+/**
+ * FEProblem of the momentum predictor that captures the split operators of
+ * the momentum matrix A = D + H every time the Jacobian is assembled: the
+ * inverse diagonal D^-1 and the off-diagonal part H. The operators are thus
+ * exactly those of the last Jacobian used by the solve, which stays true with
+ * line searches and Jacobian lagging, and no assembly is needed after the
+ * solve. CustomTransient reads them in postStep.
+ *
+ * With ainv_type = block_diagonal the dim x dim momentum block of every cell
+ * is inverted instead of the scalar diagonal, and H = A - blockdiag(A). The
+ * velocity dofs of a cell must then be numbered contiguously, which libMesh
+ * does for the components of one variable group (same family and order).
+ */
+class SplitFEProblem : public FEProblem
+{
+public:
+  static InputParameters validParams();
+
+  SplitFEProblem(const InputParameters & parameters);
+  virtual ~SplitFEProblem();
+
+  virtual void computeJacobianSys(NonlinearImplicitSystem & sys,
+                                  const NumericVector<Number> & soln,
+                                  SparseMatrix<Number> & jacobian) override;
+
+  /// Whether a Jacobian has been captured since the last mesh change
+  bool hasSplitOperators() const { return _inv_diag != nullptr; }
+
+  /// The inverse diagonal of the last assembled Jacobian
+  Vec inverseDiagonal() const;
+
+  /// The last assembled Jacobian with a zero diagonal (or zero cell blocks)
+  Mat offDiagonal() const;
+
+  /// Whether the cell blocks rather than the scalar diagonal are inverted
+  bool blockDiagonal() const { return _block_diagonal; }
+
+  /**
+   * Returns an entry of the inverted cell block of the last assembled Jacobian
+   * @param row The local row, a velocity dof of a cell
+   * @param col The column, a velocity dof of the same cell
+   */
+  Real inverseBlockEntry(dof_id_type row, dof_id_type col) const;
+
+  virtual void meshChanged() override;
+
+  /// Records the aux kernel sweeps with the TraceRecorder
+  virtual void computeAuxiliaryKernels(const ExecFlagType & type) override;
+
+protected:
+  /// Copies the split operators out of the freshly assembled \p jacobian
+  void captureSplitOperators(Mat jacobian);
+
+  /// Releases the captured operators
+  void destroySplitOperators();
+
+  /// Derives the variable block layout of the local rows from the velocity dof numbering
+  void buildCellBlocks();
+
+  /// Whether to capture the operators at all
+  const bool _capture;
+
+  /// Whether to invert the cell blocks rather than the scalar diagonal
+  const bool _block_diagonal;
+
+  /// Velocity variables forming the cell blocks
+  const std::vector<VariableName> & _block_vars;
+
+  /// Sizes of the diagonal blocks of the local rows, in row order
+  std::vector<PetscInt> _block_sizes;
+
+  /// The diagonal block a local row belongs to
+  struct RowBlock
+  {
+    /// First row of the block
+    dof_id_type first_row;
+    /// Number of rows of the block
+    unsigned int size;
+    /// Offset of the block in _inv_blocks
+    std::size_t offset;
+  };
+
+  /// First local row, and the block of every local row
+  dof_id_type _first_local_row;
+  std::vector<RowBlock> _row_blocks;
+
+  /// Inverted diagonal blocks, each stored column major
+  std::vector<PetscScalar> _inv_blocks;
+
+  /// Captured operators, allocated on the first capture
+  Vec _inv_diag;
+  Mat _off_diag;
+
+  /// Number of nonzeros of the captured off-diagonal matrix, to detect pattern changes
+  PetscLogDouble _off_diag_nnz;
+};
@@ -10,6 +10,9 @@
 #pragma once
 
 #include "MultiAppTransfer.h"
+#include "MeshChangedInterface.h"
+
+#include <map>
 
 // Forward declarations
 class MultiAppFieldTransfer_old;
@@ -25,7 +28,7 @@ InputParameters validParams<MultiAppFieldTransfer_old>();
 /**
  *  intermediary class that allows variable names as inputs
  */
-class MultiAppFieldTransfer_old : public MultiAppTransfer
+class MultiAppFieldTransfer_old : public MultiAppTransfer, public MeshChangedInterface
 {
 public:
   static InputParameters validParams();
@@ -34,22 +37,54 @@ public:
 
   virtual void initialSetup();
 
+  /**
+   * Drops the dof maps, which the mesh change has renumbered. Called for a change of the mesh
+   * of this app as well as of the local sub apps.
+   */
+  virtual void meshChanged() override;
+
 protected:
   /**
    * Performs the transfer of a variable between two problems if they have the same mesh.
    */
   void transfer(FEProblemBase & to_problem, FEProblemBase & from_problem);
 
+  /// The dofs of one transferred variable, matched between the two systems
+  struct DofMap
+  {
+    std::vector<numeric_index_type> to_dofs;
+    std::vector<numeric_index_type> from_dofs;
+    /// Sizes of the two systems when the map was built, to detect a reinitialized sub app
+    dof_id_type to_n_dofs = 0;
+    dof_id_type from_n_dofs = 0;
+    bool built = false;
+  };
+
   /**
-   * Performs the transfer of values between a node or element.
+   * Returns the dof map between two variables, building it on the first transfer, after
+   * a mesh change and whenever either system has been resized
    */
-  void transferDofObject(libMesh::DofObject * to_object,
-                         libMesh::DofObject * from_object,
-                         MooseVariableFieldBase & to_var,
-                         MooseVariableFieldBase & from_var);
+  const DofMap & dofMap(MeshBase & to_mesh,
+                        MeshBase & from_mesh,
+                        MooseVariableFieldBase & to_var,
+                        MooseVariableFieldBase & from_var);
+
+  /**
+   * Adds the dofs of a node or element to a dof map.
+   */
+  void addDofObject(DofMap & map,
+                    const libMesh::DofObject * to_object,
+                    const libMesh::DofObject * from_object,
+                    MooseVariableFieldBase & to_var,
+                    MooseVariableFieldBase & from_var);
 
   /// Virtual function defining variables to be transferred
   virtual std::vector<VariableName> getFromVarNames() const = 0;
   /// Virtual function defining variables to transfer to
   virtual std::vector<AuxVariableName> getToVarNames() const = 0;
+
+private:
+  /// Dof maps of the transferred variables, for every app
+  std::map<std::pair<const MooseVariableFieldBase *, const MooseVariableFieldBase *>, DofMap>
+      _dof_maps;
 };
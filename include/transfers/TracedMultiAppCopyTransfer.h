@@ -0,0 +1,27 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MultiAppCopyTransfer.h"
+
+/**
+ * The stock MultiAppCopyTransfer, recording its executions with the
+ * TraceRecorder like MultiAppCopyTransfer_old does. Unlike the latter it
+ * copies into the current solution of the target.
+ */
+class TracedMultiAppCopyTransfer : public MultiAppCopyTransfer
+{
+public:
+  static InputParameters validParams();
+
+  TracedMultiAppCopyTransfer(const InputParameters & parameters);
+
+  virtual void execute() override;
+};
@@ -0,0 +1,48 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/**
+ * Records a timeline of a window of time steps with the TraceRecorder and
+ * writes it, gathered from all ranks, as a Chrome trace JSON file. Each rank
+ * is a process of the trace and each app (and thread) a track. Add it to the
+ * main app only: the recorder is shared with the sub apps of the process.
+ */
+class ChromeTraceWriter : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  ChromeTraceWriter(const InputParameters & parameters);
+
+  virtual void timestepSetup() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Gathers the events of all ranks and writes the trace file on rank 0
+  void write();
+
+  /// First recorded time step
+  const int _start_step;
+
+  /// Last recorded time step
+  const int _end_step;
+
+  /// The trace file
+  const std::string _file;
+
+  /// Begin of the current time step, for the time step event
+  double _step_begin;
+};
@@ -0,0 +1,65 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementUserObject.h"
+#include "MooseVariableFV.h"
+
+/**
+ * Reconstructs the cell gradients of a set of finite volume variables once per
+ * execution in a single (threaded) element sweep, so that aux kernels and
+ * kernels reading the same gradients do not repeat the Green-Gauss
+ * reconstruction. Only the values of the gradients are stored, in one flat
+ * array per variable indexed by the local dof of the cell.
+ */
+class FVCellGradientCache : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  FVCellGradientCache(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override {}
+
+  /**
+   * @return The index of the variable \p var_name in the cache
+   */
+  unsigned int variableIndex(const VariableName & var_name) const;
+
+  /**
+   * @return The cached gradient of variable \p var_index on the local element \p elem
+   */
+  const RealVectorValue & gradient(unsigned int var_index, const Elem & elem) const;
+
+protected:
+  /// Sizes the gradient arrays for the local dofs of the variables
+  void allocate();
+
+  /// @return The index of the cell \p elem in the gradient array of variable \p var_index
+  std::size_t localIndex(unsigned int var_index, const Elem & elem) const;
+
+  /// The variables whose gradients are cached
+  std::vector<const MooseVariableFVReal *> _vars;
+
+  /// First local dof of the system of every variable
+  std::vector<dof_id_type> _first_local_dofs;
+
+  /// The cell gradients of every variable, indexed by the local dof of the cell
+  std::vector<std::vector<RealVectorValue>> _gradients;
+
+  /// Cells computed by this thread, for threadJoin
+  std::vector<const Elem *> _computed_elems;
+};
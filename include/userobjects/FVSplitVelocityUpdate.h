@@ -0,0 +1,93 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementUserObject.h"
+#include "INSFVPressureVariable.h"
+
+class FVCellGradientCache;
+class AuxiliarySystem;
+
+/**
+ * Fused replacement for one FVHhat or FVCorrector aux kernel per momentum
+ * component. In a single element sweep it either builds Hhat for every
+ * component (stage = hhat) or corrects every velocity component with the new
+ * pressure gradient (stage = correction). The pressure gradient and element
+ * volume are evaluated once per element and reused across the components.
+ *
+ * Each thread collects the new values with their dofs, and finalize inserts
+ * them into the auxiliary solution at once. The object runs before the aux
+ * kernels of its execute_on flags, and it supplies the updated variables, so
+ * the aux kernels and the later user objects read the new values.
+ */
+class FVSplitVelocityUpdate : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  FVSplitVelocityUpdate(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+protected:
+  /// Returns the pressure gradient used by the current stage on the current element
+  RealVectorValue pressureGradient() const;
+
+  /// Returns the entry (i, j) of the inverted momentum cell block on the current element
+  Real ainv(unsigned int i, unsigned int j) const;
+
+  enum class Stage
+  {
+    HHAT,
+    CORRECTION
+  };
+
+  /// Which half of the velocity update this object performs
+  const Stage _stage;
+
+  /// Number of momentum components
+  const unsigned int _dim;
+
+  /// The auxiliary system holding the updated variables
+  AuxiliarySystem & _aux_sys;
+
+  /// Variable numbers of the updated variables, one per component
+  std::vector<unsigned int> _var_nums;
+
+  // Pressures
+  const INSFVPressureVariable * const _p_var;
+  const INSFVPressureVariable * const _p_old;
+
+  /// Optional shared cell gradients, and the indices of the pressures in them
+  const FVCellGradientCache * const _grad_cache;
+  const unsigned int _p_grad_index;
+  const unsigned int _p_old_grad_index;
+
+  /// Transfer Variables, one per component
+  std::vector<const VariableValue *> _Ainv;
+  /// Off-diagonal entries of the inverted cell blocks, row by row; empty for a diagonal Ainv
+  std::vector<const VariableValue *> _Ainv_offdiag;
+  std::vector<const VariableValue *> _Hu;
+  std::vector<const VariableValue *> _rhs;
+  std::vector<const VariableValue *> _Hhat;
+
+  /// Pressure relaxation factor of the correction stage
+  const Real _pressure_relaxation;
+
+  /// Dofs of the updated variables on the cells of this thread, and their new values
+  std::vector<numeric_index_type> _dofs;
+  std::vector<Number> _values;
+
+  /// Begin of the current sweep on the TraceRecorder timeline
+  double _sweep_begin;
+};
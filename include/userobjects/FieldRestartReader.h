@@ -0,0 +1,56 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/**
+ * Restarts the primitive fields from the per-rank files written by
+ * FieldRestartOutput. Every rank memory maps its own file and copies the
+ * values of its dofs, found by node or element id, straight into the
+ * solutions; the old solutions are set to the same values. The mesh and the
+ * number of processes must be those of the run that wrote the files.
+ * Executed on initial, after the initial conditions.
+ *
+ * The executioner resets the step and the time after the initial execution,
+ * so they are restored at the setup of the first time step instead: the run
+ * continues with step t_step + 1 from the time of the restart, and the files
+ * of a FieldRestartOutput are numbered after those of the restart rather than
+ * written over them. The first time step itself is still the one chosen by
+ * the time stepper.
+ */
+class FieldRestartReader : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  FieldRestartReader(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  virtual void timestepSetup() override;
+
+protected:
+  /// The files to read, without the rank suffix
+  const std::string _file;
+
+  /// Whether to also restore the step, the time and the time step
+  const bool _restore_time;
+
+  /// Whether the step and the time of the restart still have to be restored
+  bool _restore_pending;
+
+  /// The step, the time and the time step of the restart
+  int _restart_t_step;
+  Real _restart_time;
+  Real _restart_dt;
+};
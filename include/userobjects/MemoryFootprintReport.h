@@ -0,0 +1,51 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+namespace libMesh
+{
+class System;
+}
+
+/**
+ * Prints a breakdown of the memory held by this application: mesh, FaceInfo
+ * storage, every vector of the nonlinear and auxiliary systems, the system matrix,
+ * the Rhie-Chow coefficient cache and the process resident set size. Each
+ * entry is summed over the processes and the largest per-process value is
+ * shown next to it. Add one to every app of a MultiApp run to compare them.
+ * Mesh and cache sizes are estimates from the object counts.
+ */
+class MemoryFootprintReport : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  MemoryFootprintReport(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// One line of the report, in bytes on this process
+  struct Entry
+  {
+    std::string name;
+    unsigned long long bytes;
+  };
+
+  /// Appends the vectors and matrices of \p sys to \p entries
+  void addSystem(const System & sys, std::vector<Entry> & entries) const;
+
+  /// Time steps to report at on timestep_end. All time steps if empty
+  const std::vector<int> & _report_steps;
+};
@@ -0,0 +1,85 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementUserObject.h"
+#include "WallFunctionUtils.h"
+
+/**
+ * Solves the log-law of the standard velocity wall functions for the friction
+ * velocity of all wall-adjacent cells at once. The cell data are gathered into
+ * flat arrays during the element sweep and the Newton iterations are then run
+ * on plain doubles over fixed-size chunks of cells, without per-cell branching,
+ * so that the compiler can vectorize them. Each solve is warm-started from the
+ * friction velocity of the previous execution.
+ */
+class WallFunctionFrictionVelocity : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  WallFunctionFrictionVelocity(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+  /**
+   * @return The wall shear stress rho * u*^2 on \p elem, zero away from the walls
+   */
+  Real wallShearStress(const Elem & elem) const;
+
+protected:
+  /**
+   * Runs the Newton iterations for one chunk of cells
+   * @param n The number of cells in the chunk
+   * @param speed The wall-parallel speeds
+   * @param nu The kinematic viscosities
+   * @param dist The wall distances
+   * @param u_star The initial guesses on input, the friction velocities on output
+   * @return The index of a cell that did not converge, or n if all did
+   */
+  std::size_t
+  solveChunk(std::size_t n, const Real * speed, const Real * nu, const Real * dist, Real * u_star);
+
+  /// velocity components
+  const VariableValue & _u_vel;
+  const VariableValue & _v_vel;
+  const VariableValue & _w_vel;
+
+  /// density
+  const Real _rho;
+
+  /// dynamic viscosity
+  const ADMaterialProperty<Real> & _mu;
+
+  /// Wall boundaries
+  const std::vector<BoundaryName> & _wall_boundary_names;
+
+  /// Newton iteration controls
+  const unsigned int _max_its;
+  const Real _rel_tol;
+
+  /// Wall-adjacent cells, keyed by element id
+  std::unordered_map<dof_id_type, WallFunction::WallCell> _wall_cells;
+
+  /// Cells gathered during the sweep, stored as one array per quantity
+  std::vector<dof_id_type> _elem_ids;
+  std::vector<Real> _speed;
+  std::vector<Real> _nu;
+  std::vector<Real> _dist;
+
+  /// Friction velocity per wall cell, also the initial guess of the next solve
+  std::unordered_map<dof_id_type, Real> _u_star;
+};
@@ -0,0 +1,62 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * Binary layout of the field-only restart files written by FieldRestartOutput
+ * and read by FieldRestartReader. Every rank writes the dofs it owns to its own
+ * file <prefix>.<rank>.bin, in native byte order:
+ *
+ *   Header
+ *   for every variable:
+ *     VariableHeader
+ *     uint64_t ids[n_objects]          node or element ids, ascending
+ *     uint64_t offsets[n_objects + 1]  start of the values of each object
+ *     double   values[n_values]        the dof values, component by component
+ *
+ * All sections are 8 byte aligned, so the arrays can be used in place from a
+ * memory mapped file.
+ */
+namespace FieldRestart
+{
+/// Identifies the files, and changes with every incompatible layout change
+constexpr char magic[8] = {'F', 'L', 'D', 'R', 'S', 'T', '0', '1'};
+
+struct Header
+{
+  char magic[8];
+  uint32_t n_procs;
+  uint32_t rank;
+  uint64_t n_variables;
+  int64_t t_step;
+  double time;
+  double dt;
+};
+
+struct VariableHeader
+{
+  /// Null terminated variable name
+  char name[64];
+  /// Whether the ids are node (1) or element (0) ids
+  uint64_t nodal;
+  uint64_t n_objects;
+  uint64_t n_values;
+};
+
+/// The file of \p rank for the restart files starting with \p prefix
+inline std::string
+fileName(const std::string & prefix, const unsigned int rank)
+{
+  return prefix + "." + std::to_string(rank) + ".bin";
+}
+}
@@ -0,0 +1,112 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Process-wide timeline recorder shared by all the apps of a MultiApp run.
+ * While recording, instrumented code adds begin/end events tagged with the app
+ * (and thread) they ran on; the events are exported in the Chrome trace event
+ * format (chrome://tracing, Perfetto). Recording is off by default and a
+ * disabled Scope costs a single atomic load. See ChromeTraceWriter.
+ */
+class TraceRecorder
+{
+public:
+  /// The recorder of this process
+  static TraceRecorder & instance();
+
+  /**
+   * Discards the recorded events and starts recording. Timestamps are relative to this call,
+   * so starting right after a barrier aligns the timelines of the processes
+   */
+  void start();
+
+  /// Stops recording, keeping the recorded events
+  void stop() { _enabled = false; }
+
+  /// Whether events are being recorded
+  bool enabled() const { return _enabled; }
+
+  /// Microseconds since start()
+  double now() const;
+
+  /**
+   * Records a complete event
+   * @param name The event name
+   * @param category The event category, e.g. "solve" or "transfer"
+   * @param app The name of the app the event ran on
+   * @param tid The thread the event ran on
+   * @param begin The begin time from now()
+   * @param end The end time from now()
+   */
+  void addEvent(const std::string & name,
+                const std::string & category,
+                const std::string & app,
+                THREAD_ID tid,
+                double begin,
+                double end);
+
+  /**
+   * @return The recorded events and the track names as comma separated Chrome trace events
+   * @param pid The process id to give the events, usually the rank
+   */
+  std::string toJSON(processor_id_type pid) const;
+
+  /// Records an event spanning the lifetime of the object
+  class Scope
+  {
+  public:
+    Scope(const std::string & name,
+          const std::string & category,
+          const std::string & app,
+          THREAD_ID tid = 0);
+    ~Scope();
+
+  private:
+    const bool _enabled;
+    /// Copies are only made while recording
+    const std::string _name;
+    const std::string _category;
+    const std::string _app;
+    const THREAD_ID _tid;
+    const double _begin;
+  };
+
+private:
+  TraceRecorder() = default;
+
+  struct Event
+  {
+    std::string name;
+    std::string category;
+    unsigned int track;
+    double begin;
+    double end;
+  };
+
+  std::atomic<bool> _enabled{false};
+  std::chrono::steady_clock::time_point _start;
+
+  /// Guards the events and tracks, which threads of any app may add to
+  mutable std::mutex _mutex;
+  std::vector<Event> _events;
+
+  /// Track index per app and thread
+  std::map<std::pair<std::string, THREAD_ID>, unsigned int> _tracks;
+};
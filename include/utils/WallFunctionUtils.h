@@ -0,0 +1,38 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/point.h"
+
+#include <unordered_map>
+
+class MooseMesh;
+
+namespace WallFunction
+{
+/// Nearest wall face of a wall-adjacent cell
+struct WallCell
+{
+  /// Outward normal of the wall face
+  Point normal;
+  /// Distance from the cell center to the wall face along the normal
+  Real dist;
+};
+
+/**
+ * Builds the table of the local wall-adjacent cells, keyed by element id, from
+ * the boundary side list of \p mesh. Only the nearest wall face of each cell is kept.
+ * @param mesh The mesh holding the wall boundaries
+ * @param walls The names of the wall boundaries
+ */
+std::unordered_map<dof_id_type, WallCell> buildWallCells(MooseMesh & mesh,
+                                                         const std::vector<BoundaryName> & walls);
+}
@@ -1,3 +1,6 @@
+# Exodus output every output_interval time steps
+output_interval = 10
+
 [Mesh]
   [gen]
     type = GeneratedMeshGenerator
@@ -84,49 +87,44 @@
   # []
 []
 
-[AuxKernels]
-  [Hhat_x]
-    type = FVHhat
-    variable = Hhat_x
+[UserObjects]
+  [pressure_gradients]
+    type = FVCellGradientCache
+    variables = 'pressure_p pressure_old'
+    execute_on = 'timestep_begin timestep_end'
+  []
+  [Hhat]
+    type = FVSplitVelocityUpdate
+    stage = hhat
+    variables = 'Hhat_x Hhat_y'
     execute_on = timestep_begin
     pressure = pressure_p
-    Ainv = Ainv_x
-    Hu = Hu_x
-    rhs = RHS_x
-    momentum_component = 'x'
-  []
-  [Hhat_y]
-    type = FVHhat
-    variable = Hhat_y
-    execute_on = timestep_begin
-    pressure = pressure_p
-    Ainv = Ainv_y
-    Hu = Hu_y
-    rhs = RHS_y
-    momentum_component = 'y'
-  []
-  [corrector_x]
-    type = FVCorrector
-    variable = u_adv
+    Ainv = 'Ainv_x Ainv_y'
+    Hu = 'Hu_x Hu_y'
+    rhs = 'RHS_x RHS_y'
+    gradient_cache = pressure_gradients
+  []
+  [corrector]
+    type = FVSplitVelocityUpdate
+    stage = correction
+    variables = 'u_adv v_adv'
     execute_on = timestep_end
     pressure = pressure_p
     pressure_old = pressure_old
-    Ainv = Ainv_x
-    Hhat = Hhat_x
-    momentum_component = 'x'
+    Ainv = 'Ainv_x Ainv_y'
+    Hhat = 'Hhat_x Hhat_y'
     pressure_relaxation = 1.0
+    gradient_cache = pressure_gradients
   []
-  [corrector_y]
-    type = FVCorrector
-    variable = v_adv
-    execute_on = timestep_end
-    pressure = pressure_p
-    pressure_old = pressure_old
-    Ainv = Ainv_y
-    Hhat = Hhat_y
-    momentum_component = 'y'
-    pressure_relaxation = 1.0
+  [memory]
+    type = MemoryFootprintReport
   []
+  # Timeline of one time step of all apps, open in chrome://tracing or ui.perfetto.dev
+  # [trace]
+  #   type = ChromeTraceWriter
+  #   start_step = 5
+  #   num_steps = 1
+  # []
 []
 
 [FVBCs]
@@ -162,6 +160,15 @@
 #   [../]
 # []
 
+# Geometric multigrid on agglomerated cells instead of ASM for the pressure. Remove -pc_type and
+# the -sub_ options from the Executioner when enabling it
+# [Preconditioning]
+#   [gmg]
+#     type = GMG
+#     coarse_size = 500
+#   []
+# []
+
 [Executioner]
   type = Transient
   num_steps = 2
@@ -177,6 +184,10 @@
     type = TransientMultiApp
     input_files = FV_Channel_Momentum_Predictor.i
     execute_on = TIMESTEP_BEGIN
+    # The predictor works on a copy of this mesh, so its partitioning and numbering match those
+    # of this app for the copy transfers; its [Mesh] block is then ignored. The copy takes as
+    # much memory as the mesh itself
+    clone_master_mesh = true
     sub_cycling = false
   []
 []
@@ -283,6 +294,17 @@
 
 [Outputs]
   file_base = channel
-  exodus = true
-  checkpoint = true
+  # The split operators (Ainv_*, Hu_*, Hhat_*, RHS_*) and the star velocities only carry data
+  # between the apps, so only the physical fields are written
+  [exodus]
+    type = Exodus
+    show = 'u_adv v_adv pressure_p'
+    interval = ${output_interval}
+  []
+  # Only the primitive fields are needed to restart the split solver. Restart with a
+  # FieldRestartReader UserObject, file = channel_fields_<step>
+  [fields]
+    type = FieldRestartOutput
+    variables = 'u_adv v_adv pressure_p pressure_old'
+  []
 []
@@ -1,3 +1,6 @@
+# Exodus output every output_interval time steps, when enabled
+output_interval = 50
+
 mu=1.1
 rho=1.0
 U=0.1
@@ -5,6 +8,7 @@ advected_interp_method='average'
 #velocity_interp_method='rc'
 velocity_interp_method='average'
 
+# Only used when run on its own; the main app passes a copy of its mesh
 [Mesh]
   [gen]
     type = GeneratedMeshGenerator
@@ -19,6 +23,11 @@ velocity_interp_method='average'
 []
 
 [Problem]
+  # Captures the split operators when the Jacobian is assembled, see CustomTransient
+  type = SplitFEProblem
+  # Inverting the u-v block of each cell also needs the Ainv_xy and Ainv_yx aux variables here
+  # and in the main app, their transfers, and Ainv_offdiag = 'Ainv_xy Ainv_yx' in its updates
+  # ainv_type = block_diagonal
   fv_bcs_integrity_check = true
 []
 
@@ -187,8 +196,36 @@ velocity_interp_method='average'
   []
 []
 
+[UserObjects]
+  [memory]
+    type = MemoryFootprintReport
+  []
+[]
+
+[Postprocessors]
+  [rc_hits]
+    type = FVKernelCounter
+    counter = rc_hits
+    per_execution = true
+  []
+  [rc_misses]
+    type = FVKernelCounter
+    counter = rc_misses
+    per_execution = true
+  []
+  [predictor_faces]
+    type = FVKernelCounter
+    counter = faces
+    kernels = 'u_adv_diff_residual v_adv_diff_residual'
+    per_execution = true
+  []
+[]
+
 [Executioner]
   type = CustomTransient
+  # Start every solve from the quadratic extrapolation of the last three steps. With a LINEAR
+  # solve this pays off together with an absolute linear tolerance (l_abs_tol)
+  # initial_guess = quadratic
   #num_steps = 10
   #dt = .06
   #dtmin =
@@ -220,7 +257,13 @@ velocity_interp_method='average'
   verbose_print = false
 []
 
-# [Outputs]
-#   file_base = channel_sub
-#   exodus = true
-# []
+# The predictor only writes on request, at its own cadence, e.g. to check the star velocity
+# from the main app: sub_predictor:Outputs/exodus/enable=true sub_predictor:output_interval=5
+[Outputs]
+  [exodus]
+    type = Exodus
+    show = 'u v'
+    interval = ${output_interval}
+    enable = false
+  []
+[]
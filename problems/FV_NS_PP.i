@@ -46,10 +46,14 @@ velocity_interp_method='rc'
   [pressure_correction]
     type = FVNavStokesPressurePoisson_p
     variable = pressure
-    u_star = u_star
-    v_star = v_star
     pressure_old = p_old
     mu = ${mu}
+  []
+  [pressure_correction_source]
+    type = FVNavStokesPressurePoissonSource_p
+    variable = pressure
+    u_star = u_star
+    v_star = v_star
     rho = ${rho}
   []
 []
@@ -17,6 +17,8 @@ velocity_interp_method='rc'
 []
 
 [Problem]
+  # Captures the split operators when the Jacobian is assembled, see CustomTransient
+  type = SplitFEProblem
   fv_bcs_integrity_check = true
 []
 
@@ -0,0 +1,132 @@
+#!/usr/bin/env python
+"""
+Nested iteration startup of the Chorin airfoil pipeline.
+
+Runs NS_Master_airfoil.i on a family of increasingly fine meshes. Every level
+but the last is run to a loose steady state tolerance (or a step budget), and
+the next level starts from its solution instead of the constant initial
+values: the NestedIterationFunction initial conditions of the main and the
+predictor app are pointed, on the command line, at a SolutionUserObject
+reading the previous level's Exodus output, and the initial condition
+projection maps it onto the new mesh. The last level runs the deck's own
+executioner settings, so only the startup transient is spent on the coarse
+meshes.
+
+Examples:
+  scripts/nested_iteration.py --executable ./airfoil_app-opt
+  scripts/nested_iteration.py --meshes Re100CoarseMesh,Re100FineMesh --level-steps 200 -n 8
+  scripts/nested_iteration.py --meshes Mesh1,Mesh2,Mesh3 --tolerance 1e-3 -- Executioner/num_steps=500
+"""
+import argparse
+import os
+import subprocess
+import sys
+import time
+
+REPO_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), '..'))
+INPUT = 'NS_Master_airfoil.i'
+MULTIAPP = 'sub_predictor'
+
+# Variables with a NestedIterationFunction initial condition, per app ('' is the main app)
+PROJECTED = {
+  '': ['p', 'u_star', 'v_star', 'u', 'v'],
+  MULTIAPP + ':': ['u_star', 'v_star', 'u', 'v', 'p'],
+}
+
+
+def meshFile(name):
+  """ Returns the path of a mesh of the family, given as a path or a name like Re100CoarseMesh """
+  for path in (name, os.path.join(REPO_DIR, 'AirfoilMeshes', name + '.exo'),
+               os.path.join(REPO_DIR, name + '.exo')):
+    if os.path.isfile(path):
+      return os.path.abspath(path)
+  raise IOError('Unknown mesh %s' % name)
+
+
+def outputFiles(file_base):
+  """ The Exodus files the main and the predictor app write under file_base """
+  return {'': file_base + '.e', MULTIAPP + ':': '%s_%s0.e' % (file_base, MULTIAPP)}
+
+
+def projectionArgs(previous_base):
+  """ Command line arguments starting both apps from the solution written under previous_base """
+  args = []
+  for prefix, exodus in outputFiles(previous_base).items():
+    if not os.path.isfile(exodus):
+      raise IOError('The previous level did not write %s' % exodus)
+    uo = '%sUserObjects/nested_solution' % prefix
+    args += ['%s/type=SolutionUserObject' % uo,
+             '%s/mesh=%s' % (uo, exodus),
+             '%s/timestep=LATEST' % uo,
+             "%s/system_variables='%s'" % (uo, ' '.join(PROJECTED[prefix]))]
+    args += ['%sFunctions/%s_ic/solution=nested_solution' % (prefix, var) for var in PROJECTED[prefix]]
+  return args
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__,
+                                   formatter_class=argparse.RawDescriptionHelpFormatter)
+  parser.add_argument('--executable', default=os.path.join(REPO_DIR, 'airfoil_app-opt'),
+                      help='The application executable')
+  parser.add_argument('--meshes', default='Re100CoarseMesh,Re100MediumMesh,Re100FineMesh',
+                      help='Comma separated meshes, coarsest first')
+  parser.add_argument('--tolerance', type=float, default=1e-4,
+                      help='Steady state tolerance of the startup levels')
+  parser.add_argument('--level-steps', type=int, default=100,
+                      help='Maximum time steps of each startup level')
+  parser.add_argument('-n', '--n-procs', type=int, default=1, help='Number of MPI processes')
+  parser.add_argument('--mpiexec', default='mpiexec', help='The MPI launcher')
+  parser.add_argument('--output-dir', default=os.path.join(REPO_DIR, 'nested_iteration'),
+                      help='Directory for the logs and the output of every level')
+  parser.add_argument('extra', nargs='*', help='Extra command line arguments of the last level')
+  opts = parser.parse_args()
+
+  meshes = opts.meshes.split(',')
+  out_dir = os.path.abspath(opts.output_dir)
+  if not os.path.isdir(out_dir):
+    os.makedirs(out_dir)
+
+  previous_base = None
+  for level, mesh in enumerate(meshes):
+    last = level == len(meshes) - 1
+    mesh_file = meshFile(mesh)
+    file_base = os.path.join(out_dir, 'level%d_%s' % (level, os.path.splitext(os.path.basename(mesh_file))[0]))
+
+    cmd = []
+    if opts.n_procs > 1:
+      cmd += [opts.mpiexec, '-n', str(opts.n_procs)]
+    cmd += [os.path.abspath(opts.executable), '-i', INPUT,
+            'Mesh/fmg/file=%s' % mesh_file,
+            '%s:Mesh/fmg/file=%s' % (MULTIAPP, mesh_file),
+            'Outputs/file_base=%s' % file_base,
+            # Every step, and every field the next level projects
+            'output_interval=1',
+            "Outputs/exodus/show='%s'" % ' '.join(PROJECTED['']),
+            '%s:Outputs/exodus/enable=true' % MULTIAPP,
+            '%s:output_interval=1' % MULTIAPP,
+            "%s:Outputs/exodus/show='%s'" % (MULTIAPP, ' '.join(PROJECTED[MULTIAPP + ':']))]
+    if not last:
+      cmd += ['Executioner/num_steps=%d' % opts.level_steps,
+              'Executioner/steady_state_detection=true',
+              'Executioner/steady_state_tolerance=%g' % opts.tolerance]
+    else:
+      cmd += opts.extra
+    if previous_base:
+      cmd += projectionArgs(previous_base)
+
+    print('Level %d: %s' % (level, mesh_file))
+    start = time.time()
+    with open(file_base + '.log', 'w') as log:
+      returncode = subprocess.call(cmd, cwd=REPO_DIR, stdout=log, stderr=subprocess.STDOUT)
+    print('  %s in %.1fs, log %s.log' % ('done' if returncode == 0 else 'FAILED', time.time() - start, file_base))
+    if returncode != 0:
+      return returncode
+
+    previous_base = file_base
+
+  print('Final solution: %s' % outputFiles(previous_base)[''])
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,245 @@
+#!/usr/bin/env python
+"""
+Benchmarks for the split Navier-Stokes pipelines.
+
+Runs the FV channel pipeline on generated meshes of increasing size and the
+Chorin airfoil pipeline on the Re100 airfoil meshes. For every case the main
+and the predictor sub app record, through postprocessors added on the command
+line, the time spent in each stage of the pipeline, the memory high-water mark
+and the nonlinear/linear iteration counts. The results are written to a JSON
+file, which can be compared against a previous run with --baseline.
+
+Examples:
+  scripts/run_benchmarks.py --executable ./airfoil_app-opt
+  scripts/run_benchmarks.py --cases channel --num-steps 5 -n 4
+  scripts/run_benchmarks.py --baseline bench_results/base.json --tolerance 0.15
+"""
+import argparse
+import csv
+import datetime
+import glob
+import json
+import os
+import subprocess
+import sys
+import time
+
+REPO_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), '..'))
+
+# Pipeline stages and the perf graph section timing them. 'main' is the pressure
+# app, 'sub' is the momentum predictor multiapp. The 'approximate' stages have no
+# dedicated section: theirs also times unrelated objects run alongside (all the user
+# objects, or all the aux kernels), so their numbers are upper bounds. Their
+# postprocessors, and thus the CSV columns, end in _approx.
+PIPELINES = {
+  'channel': {
+    'dir': 'problems',
+    'input': 'FV_Channel_Main_App.i',
+    'multiapp': 'sub_predictor',
+    'stages': {
+      'momentum_predictor': ('sub', 'FEProblem::solve'),
+      'split_extraction': ('sub', 'CustomTransient::postStep'),
+      'pressure': ('main', 'FEProblem::solve'),
+      'correction': ('main', 'FEProblem::computeUserObjects'),
+      'transfers': ('main', 'FEProblem::execMultiAppTransfers'),
+    },
+    'approximate': ['correction'],
+  },
+  'airfoil': {
+    'dir': '.',
+    'input': 'NS_Master_airfoil.i',
+    'multiapp': 'sub_predictor',
+    'stages': {
+      'momentum_predictor': ('sub', 'FEProblem::solve'),
+      'pressure': ('main', 'FEProblem::solve'),
+      'correction': ('main', 'FEProblem::computeAuxiliaryKernels'),
+      'transfers': ('main', 'FEProblem::execMultiAppTransfers'),
+    },
+    # The Chorin pipeline builds no split operators, so it has no split_extraction stage
+    'approximate': ['correction'],
+  },
+}
+
+# Channel meshes double in both directions; the airfoil meshes are the Re100 family
+CASES = [
+  {'name': 'channel_%dx%d' % (nx, nx // 5), 'pipeline': 'channel',
+   'mesh': ['Mesh/gen/nx=%d' % nx, 'Mesh/gen/ny=%d' % (nx // 5)]}
+  for nx in (50, 100, 200, 400, 800)
+] + [
+  {'name': 'airfoil_Re100%s' % size, 'pipeline': 'airfoil',
+   'mesh': ['Mesh/fmg/file=%s' % os.path.join(REPO_DIR, 'AirfoilMeshes', 'Re100%sMesh.exo' % size)]}
+  for size in ('Coarse', 'Medium', 'Fine')
+]
+
+
+def ppName(stage, approximate):
+  """ Name of the postprocessor timing a stage """
+  return 'bench_' + stage + ('_approx' if stage in approximate else '')
+
+
+def appArgs(prefix, file_base, stages, approximate, app):
+  """ Command line arguments adding the benchmark postprocessors and CSV output to one app """
+  args = []
+  for stage, (stage_app, section) in stages.items():
+    if stage_app != app:
+      continue
+    pp = '%sPostprocessors/%s' % (prefix, ppName(stage, approximate))
+    args += ['%s/type=PerfGraphData' % pp,
+             '%s/section_name=%s' % (pp, section),
+             '%s/data_type=TOTAL' % pp,
+             '%s/must_exist=false' % pp]
+
+  args += ['%sPostprocessors/bench_memory/type=MemoryUsage' % prefix,
+           '%sPostprocessors/bench_memory/mem_type=physical_memory' % prefix,
+           '%sPostprocessors/bench_memory/value_type=max_process' % prefix,
+           '%sPostprocessors/bench_memory/report_peak_value=true' % prefix,
+           '%sPostprocessors/bench_nl_its/type=NumNonlinearIterations' % prefix,
+           '%sPostprocessors/bench_l_its/type=NumLinearIterations' % prefix,
+           '%sOutputs/bench_csv/type=CSV' % prefix,
+           '%sOutputs/bench_csv/file_base=%s' % (prefix, file_base)]
+  return args
+
+
+def readCSV(file_base):
+  """ Returns the rows of the postprocessor CSV file written under file_base """
+  matches = sorted(glob.glob(file_base + '*.csv'))
+  if not matches:
+    return []
+  with open(matches[0]) as f:
+    return [{k: float(v) for k, v in row.items()} for row in csv.DictReader(f)]
+
+
+def summarize(rows, stages, approximate, app):
+  """ Extracts the stage times, memory peak and iteration counts of one app """
+  if not rows:
+    return {}
+  last = rows[-1]
+  summary = {'stages': {}}
+  for stage, (stage_app, _) in stages.items():
+    value = last.get(ppName(stage, approximate), -1)
+    if stage_app == app and value >= 0:
+      summary['stages'][stage] = value
+  summary['memory_peak'] = last.get('bench_memory')
+  summary['nonlinear_iterations'] = int(sum(row.get('bench_nl_its', 0) for row in rows))
+  summary['linear_iterations'] = int(sum(row.get('bench_l_its', 0) for row in rows))
+  return summary
+
+
+def runCase(case, opts, out_dir):
+  """ Runs one benchmark case and returns its results """
+  pipeline = PIPELINES[case['pipeline']]
+  stages = dict(pipeline['stages'])
+  for override in opts.section:
+    stage, app_section = override.split('=', 1)
+    stages[stage] = tuple(app_section.split(':', 1))
+  # An overridden section is taken as dedicated
+  approximate = [stage for stage in pipeline.get('approximate', [])
+                 if stages[stage] == pipeline['stages'].get(stage)]
+
+  sub = pipeline['multiapp'] + ':'
+  main_base = os.path.join(out_dir, case['name'] + '_main')
+  sub_base = os.path.join(out_dir, case['name'] + '_sub')
+
+  cmd = []
+  if opts.n_procs > 1:
+    cmd += [opts.mpiexec, '-n', str(opts.n_procs)]
+  cmd += [opts.executable, '-i', pipeline['input']]
+  cmd += case['mesh'] + [sub + arg for arg in case['mesh']]
+  cmd += ['Executioner/num_steps=%d' % opts.num_steps,
+          'Outputs/exodus/enable=false',
+          'Outputs/fields/enable=false']
+  cmd += (appArgs('', main_base, stages, approximate, 'main') +
+          appArgs(sub, sub_base, stages, approximate, 'sub'))
+
+  print('Running %s' % case['name'])
+  start = time.time()
+  with open(os.path.join(out_dir, case['name'] + '.log'), 'w') as log:
+    proc = subprocess.run(cmd, cwd=os.path.join(REPO_DIR, pipeline['dir']),
+                          stdout=log, stderr=subprocess.STDOUT)
+  wall_time = time.time() - start
+
+  main = summarize(readCSV(main_base), stages, approximate, 'main')
+  sub = summarize(readCSV(sub_base), stages, approximate, 'sub')
+  result = {'name': case['name'],
+            'pipeline': case['pipeline'],
+            'mesh': case['mesh'],
+            'n_procs': opts.n_procs,
+            'returncode': proc.returncode,
+            'wall_time': wall_time,
+            'stages': dict(list(main.get('stages', {}).items()) + list(sub.get('stages', {}).items())),
+            'approximate_stages': approximate}
+  for key in ('memory_peak', 'nonlinear_iterations', 'linear_iterations'):
+    result[key] = {'main': main.get(key), 'sub': sub.get(key)}
+  return result
+
+
+def compare(results, baseline_file, tolerance):
+  """ Prints the stages that got slower than the baseline and returns their number """
+  with open(baseline_file) as f:
+    baseline = {case['name']: case for case in json.load(f)['cases']}
+
+  regressions = 0
+  for case in results['cases']:
+    base = baseline.get(case['name'])
+    if not base:
+      continue
+    timings = dict(case['stages'], wall_time=case['wall_time'])
+    base_timings = dict(base['stages'], wall_time=base['wall_time'])
+    for stage, value in timings.items():
+      old = base_timings.get(stage)
+      if old and value > old * (1. + tolerance):
+        approx = ' (approximate)' if stage in case.get('approximate_stages', []) else ''
+        print('REGRESSION %s %s%s: %.3fs -> %.3fs (%+.1f%%)' %
+              (case['name'], stage, approx, old, value, 100. * (value - old) / old))
+        regressions += 1
+  return regressions
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__,
+                                   formatter_class=argparse.RawDescriptionHelpFormatter)
+  parser.add_argument('--executable', default=os.path.join(REPO_DIR, 'airfoil_app-opt'),
+                      help='The application executable')
+  parser.add_argument('--cases', default='channel,airfoil',
+                      help='Comma separated pipelines or case names to run')
+  parser.add_argument('--num-steps', type=int, default=10, help='Time steps per case')
+  parser.add_argument('-n', '--n-procs', type=int, default=1, help='Number of MPI processes')
+  parser.add_argument('--mpiexec', default='mpiexec', help='The MPI launcher')
+  parser.add_argument('--section', action='append', default=[],
+                      help='Override the perf graph section of a stage: stage=app:section')
+  parser.add_argument('--output-dir', default=os.path.join(REPO_DIR, 'bench_results'),
+                      help='Directory for the logs, CSV files and the JSON results')
+  parser.add_argument('--output', help='JSON results file (default: <output-dir>/<date>.json)')
+  parser.add_argument('--baseline', help='Previous JSON results to compare against')
+  parser.add_argument('--tolerance', type=float, default=0.1,
+                      help='Relative slowdown reported as a regression')
+  opts = parser.parse_args()
+
+  opts.executable = os.path.abspath(opts.executable)
+  out_dir = os.path.abspath(opts.output_dir)
+  if not os.path.isdir(out_dir):
+    os.makedirs(out_dir)
+
+  selected = opts.cases.split(',')
+  cases = [c for c in CASES if c['pipeline'] in selected or c['name'] in selected]
+
+  results = {'date': datetime.datetime.now().isoformat(),
+             'executable': opts.executable,
+             'num_steps': opts.num_steps,
+             'cases': [runCase(case, opts, out_dir) for case in cases]}
+
+  output = opts.output or os.path.join(out_dir, datetime.datetime.now().strftime('%Y%m%d-%H%M%S.json'))
+  with open(output, 'w') as f:
+    json.dump(results, f, indent=2)
+  print('Results written to %s' % output)
+
+  failed = [case['name'] for case in results['cases'] if case['returncode'] != 0]
+  if failed:
+    print('FAILED: %s' % ', '.join(failed))
+
+  regressions = compare(results, opts.baseline, opts.tolerance) if opts.baseline else 0
+  return 1 if failed or regressions else 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,73 @@
+# Reads the field restart of write.i, written at step 4 and time 1, and continues for two steps
+# without changing the fields
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 10
+    ny = 10
+  []
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[AuxVariables]
+  [u]
+  []
+  [w]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[UserObjects]
+  [restart]
+    type = FieldRestartReader
+    file = write_out_fields_0004
+  []
+[]
+
+[Functions]
+  [restart_field]
+    type = ParsedFunction
+    value = 'x + y'
+  []
+[]
+
+[Postprocessors]
+  # The nodal field interpolates x + y exactly
+  [u_error]
+    type = ElementL2Error
+    variable = u
+    function = restart_field
+  []
+  # The average of x + y over the element centroids is 1
+  [w_average]
+    type = ElementAverageValue
+    variable = w
+  []
+  [dt]
+    type = TimestepSize
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 0.25
+  # Counts the steps of the restart
+  num_steps = 6
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    execute_on = timestep_end
+  []
+  [fields]
+    type = FieldRestartOutput
+    variables = 'u w'
+  []
+[]
@@ -0,0 +1,58 @@
+# Writes a field restart of a nodal and an elemental field on two ranks; read.i reads it back
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 10
+    ny = 10
+  []
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[AuxVariables]
+  [u]
+  []
+  [w]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[Functions]
+  [field]
+    type = ParsedFunction
+    value = 't * (x + y)'
+  []
+[]
+
+[AuxKernels]
+  [u]
+    type = FunctionAux
+    variable = u
+    function = field
+    execute_on = 'initial timestep_end'
+  []
+  [w]
+    type = FunctionAux
+    variable = w
+    function = field
+    execute_on = 'initial timestep_end'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 0.25
+  num_steps = 4
+[]
+
+[Outputs]
+  [fields]
+    type = FieldRestartOutput
+    variables = 'u w'
+  []
+[]
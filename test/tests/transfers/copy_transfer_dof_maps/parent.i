@@ -0,0 +1,78 @@
+# Copies a nodal and an elemental field, which change every step, from a sub app on a clone
+# of this mesh. The dof maps of MultiAppCopyTransfer_old are built on the first transfer and
+# reused for the later ones
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 10
+    ny = 10
+  []
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[AuxVariables]
+  [u]
+  []
+  [w]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[MultiApps]
+  [sub]
+    type = TransientMultiApp
+    input_files = sub.i
+    execute_on = timestep_begin
+    clone_master_mesh = true
+  []
+[]
+
+[Transfers]
+  [from_sub]
+    type = MultiAppCopyTransfer_old
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = 'u w'
+    variable = 'u w'
+  []
+[]
+
+[Functions]
+  [field]
+    type = ParsedFunction
+    value = 't * (x + y)'
+  []
+[]
+
+[Postprocessors]
+  # The nodal field interpolates t * (x + y) exactly
+  [u_error]
+    type = ElementL2Error
+    variable = u
+    function = field
+  []
+  # The average of x + y over the element centroids is 1
+  [w_average]
+    type = ElementAverageValue
+    variable = w
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 0.5
+  num_steps = 3
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    execute_on = timestep_end
+  []
+[]
@@ -0,0 +1,49 @@
+# Only used through parent.i, which passes a copy of its mesh
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 2
+    ny = 2
+  []
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[AuxVariables]
+  [u]
+  []
+  [w]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[Functions]
+  [field]
+    type = ParsedFunction
+    value = 't * (x + y)'
+  []
+[]
+
+[AuxKernels]
+  [u]
+    type = FunctionAux
+    variable = u
+    function = field
+    execute_on = timestep_end
+  []
+  [w]
+    type = FunctionAux
+    variable = w
+    function = field
+    execute_on = timestep_end
+  []
+[]
+
+[Executioner]
+  type = Transient
+[]
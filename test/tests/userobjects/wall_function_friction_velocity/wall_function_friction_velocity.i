@@ -0,0 +1,120 @@
+# Compares the batched friction velocity solve of WallFunctionFrictionVelocity with the
+# per-cell findUStar solve of WallFunctionTabulatedShearStressAux on a sheared channel flow,
+# where every wall cell is in the log layer
+mu = 1e-4
+rho = 1.0
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 10
+    ny = 10
+  []
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[AuxVariables]
+  [u]
+    type = INSFVVelocityVariable
+    [InitialCondition]
+      type = FunctionIC
+      function = '1 + x * y'
+    []
+  []
+  [v]
+    type = INSFVVelocityVariable
+    initial_condition = 0.1
+  []
+  [tau_cell]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [tau_batch]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [tau_diff]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[UserObjects]
+  [friction_velocity]
+    type = WallFunctionFrictionVelocity
+    u = u
+    v = v
+    rho = ${rho}
+    mu = mu
+    walls = 'bottom top'
+    execute_on = timestep_end
+  []
+[]
+
+[AuxKernels]
+  [tau_cell]
+    type = WallFunctionTabulatedShearStressAux
+    variable = tau_cell
+    u = u
+    v = v
+    rho = ${rho}
+    mu = mu
+    walls = 'bottom top'
+    execute_on = timestep_end
+  []
+  [tau_batch]
+    type = WallFunctionTabulatedShearStressAux
+    variable = tau_batch
+    u = u
+    v = v
+    rho = ${rho}
+    mu = mu
+    walls = 'bottom top'
+    friction_velocity = friction_velocity
+    execute_on = timestep_end
+  []
+  [tau_diff]
+    type = ParsedAux
+    variable = tau_diff
+    args = 'tau_cell tau_batch'
+    function = 'abs(tau_cell - tau_batch)'
+    execute_on = timestep_end
+  []
+[]
+
+[Materials]
+  [const]
+    type = ADGenericConstantMaterial
+    prop_names = 'mu'
+    prop_values = '${mu}'
+  []
+[]
+
+[Postprocessors]
+  # Both solves stop at a relative tolerance of 1e-6, so the stresses of about 1e-3 agree
+  # to well below the abs_zero of the test
+  [max_diff]
+    type = ElementExtremeValue
+    variable = tau_diff
+    execute_on = timestep_end
+  []
+  # Guards against both being zero
+  [max_tau]
+    type = ElementExtremeValue
+    variable = tau_batch
+    execute_on = timestep_end
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,123 @@
+# Momentum predictor advection-diffusion kernels on a channel, for FVKernelBenchmark
+mu = 1.1
+rho = 1.0
+U = 0.1
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 50
+    ny = 50
+    xmin = 0.0
+    xmax = 10.0
+    ymin = 0.0
+    ymax = 10.0
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [u]
+    type = INSFVVelocityVariable
+    initial_condition = ${U}
+  []
+  [v]
+    type = INSFVVelocityVariable
+    initial_condition = 0
+  []
+[]
+
+[AuxVariables]
+  [u_adv]
+    type = INSFVVelocityVariable
+    initial_condition = ${U}
+  []
+  [v_adv]
+    type = INSFVVelocityVariable
+    initial_condition = 0.01
+  []
+  [pressure_mom]
+    type = INSFVPressureVariable
+    initial_condition = 0
+  []
+[]
+
+[FVKernels]
+  [u_adv_diff_residual]
+    type = FVNavStokesPredictor_p
+    variable = u
+    advected_quantity = 'rhou'
+    vel = 'velocity'
+    advected_interp_method = 'average'
+    velocity_interp_method = 'rc'
+    pressure = pressure_mom
+    u = u_adv
+    v = v_adv
+    mu = ${mu}
+    rho = ${rho}
+    momentum_component = 'x'
+  []
+  [v_adv_diff_residual]
+    type = FVNavStokesPredictor_p
+    variable = v
+    advected_quantity = 'rhov'
+    vel = 'velocity'
+    advected_interp_method = 'average'
+    velocity_interp_method = 'rc'
+    pressure = pressure_mom
+    u = u_adv
+    v = v_adv
+    mu = ${mu}
+    rho = ${rho}
+    momentum_component = 'y'
+  []
+[]
+
+[FVBCs]
+  [inlet-u]
+    type = INSFVInletVelocityBC
+    boundary = 'left'
+    variable = u
+    function = ${U}
+  []
+  [inlet-v]
+    type = INSFVInletVelocityBC
+    boundary = 'left'
+    variable = v
+    function = 0
+  []
+  [walls-u]
+    type = INSFVNoSlipWallBC
+    boundary = 'top bottom'
+    variable = u
+    function = 0
+  []
+  [walls-v]
+    type = INSFVNoSlipWallBC
+    boundary = 'top bottom'
+    variable = v
+    function = 0
+  []
+[]
+
+[Materials]
+  [ins_fv]
+    type = INSFVMaterial
+    u = 'u_adv'
+    v = 'v_adv'
+    pressure = 'pressure_mom'
+    rho = ${rho}
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  console = false
+[]
@@ -0,0 +1,57 @@
+# Pressure Poisson diffusion flux kernel on a channel, for FVKernelBenchmark
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 50
+    ny = 50
+    xmin = 0.0
+    xmax = 10.0
+    ymin = 0.0
+    ymax = 10.0
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [pressure]
+    type = INSFVPressureVariable
+    initial_condition = 1
+  []
+[]
+
+[AuxVariables]
+  [p_old]
+    type = INSFVPressureVariable
+    initial_condition = 0
+  []
+[]
+
+[FVKernels]
+  [pressure_correction]
+    type = FVNavStokesPressurePoisson_p
+    variable = pressure
+    pressure_old = p_old
+    mu = 1.1
+  []
+[]
+
+[FVBCs]
+  [outlet_p]
+    type = INSFVOutletPressureBC
+    boundary = 'right'
+    variable = pressure
+    function = 0
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  console = false
+[]
@@ -0,0 +1,71 @@
+# Pressure predictor flux kernel on a channel, for FVKernelBenchmark
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 50
+    ny = 50
+    xmin = 0.0
+    xmax = 10.0
+    ymin = 0.0
+    ymax = 10.0
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [pressure_p]
+    type = INSFVPressureVariable
+    initial_condition = 1
+  []
+[]
+
+[AuxVariables]
+  [Ainv_x]
+    type = MooseVariableFVReal
+    initial_condition = 0.5
+  []
+  [Ainv_y]
+    type = MooseVariableFVReal
+    initial_condition = 0.5
+  []
+  [Hhat_x]
+    type = MooseVariableFVReal
+    initial_condition = 0.1
+  []
+  [Hhat_y]
+    type = MooseVariableFVReal
+    initial_condition = 0
+  []
+[]
+
+[FVKernels]
+  [pressure_poisson_predictor]
+    type = FVNavStokesPressurePredictor_p
+    variable = pressure_p
+    Ainv_x = Ainv_x
+    Ainv_y = Ainv_y
+    Hu_x = Hhat_x
+    Hu_y = Hhat_y
+  []
+[]
+
+[FVBCs]
+  [outlet_p]
+    type = INSFVOutletPressureBC
+    boundary = 'right'
+    variable = pressure_p
+    function = 0
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  console = false
+[]